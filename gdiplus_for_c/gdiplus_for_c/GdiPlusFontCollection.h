@@ -51,11 +51,21 @@ FontCollection::GetFamilies(
         return SetStatus(InvalidParameter);
     }
     *numFound = 0;
-    GpFontFamily **nativeFamilyList = new GpFontFamily*[numSought];
 
-    if (nativeFamilyList == NULL)
+    // Enumerating a typical collection fits on the stack; only very large
+    // requests pay for a heap block.
+
+    GpFontFamily  *stackFamilyList[64];
+    GpFontFamily **nativeFamilyList = stackFamilyList;
+
+    if (numSought > (INT)(sizeof(stackFamilyList) / sizeof(stackFamilyList[0])))
     {
-        return SetStatus(OutOfMemory);
+        nativeFamilyList = new GpFontFamily*[numSought];
+
+        if (nativeFamilyList == NULL)
+        {
+            return SetStatus(OutOfMemory);
+        }
     }
 
     Status status = SetStatus(DllExports::GdipGetFontCollectionFamilyList(
@@ -73,7 +83,10 @@ FontCollection::GetFamilies(
         }
     }
 
-    delete [] nativeFamilyList;
+    if (nativeFamilyList != stackFamilyList)
+    {
+        delete [] nativeFamilyList;
+    }
 
     return status;
 }
@@ -1409,11 +1409,20 @@ public:
             return InvalidParameter;
         }
 
-        GpRegion **nativeRegions = new GpRegion* [regionCount];
+        // GDI+ accepts at most 32 measurable character ranges per
+        // StringFormat, so the common case never needs a heap block.
 
-        if (!nativeRegions)
+        GpRegion  *stackRegions[32];
+        GpRegion **nativeRegions = stackRegions;
+
+        if (regionCount > (INT)(sizeof(stackRegions) / sizeof(stackRegions[0])))
         {
-            return OutOfMemory;
+            nativeRegions = new GpRegion* [regionCount];
+
+            if (!nativeRegions)
+            {
+                return OutOfMemory;
+            }
         }
 
         for (INT i = 0; i < regionCount; i++)
@@ -1432,7 +1441,10 @@ public:
             nativeRegions
         ));
 
-        delete [] nativeRegions;
+        if (nativeRegions != stackRegions)
+        {
+            delete [] nativeRegions;
+        }
 
         return status;
     }